@@ -0,0 +1,622 @@
+/**
+ * @file numa_tables.cpp
+ * @brief NUMA-aware, huge-page-backed storage for large point and Employee tables
+ *
+ * Once the robot position arrays from corrdinates.cpp or the Employee rosters
+ * from oop_trainer.cpp grow to several GB, two costs show up that a plain
+ * std::vector ignores:
+ * - TLB misses: with 4 KB pages every 4 KB of table needs its own TLB entry
+ * - cross-socket traffic: pages end up on whichever NUMA node touched them first
+ *
+ * NumaTable<T> backs a table with huge pages (transparent or explicit),
+ * splits it into one partition per worker, pins every worker to a CPU and
+ * lets each worker construct ("first-touch") its own partition, so the pages
+ * land on the node of the worker that will later process them.
+ *
+ * On a single-node machine, without huge pages or without permission to pin
+ * threads, the same code runs with whatever is available.
+ *
+ * Build: g++ -std=c++17 -O2 -pthread numa_tables.cpp -o output/numa_tables
+ * Usage: ./output/numa_tables [points] [employees] [passes] [workers]
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/mman.h>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+/**
+ * @class point
+ * @brief 2D robot position, same interface as in corrdinates.cpp
+ */
+class point{
+
+    protected:
+        double X , Y;
+    public:
+        string Robot_type;
+    void print_position(){
+        std::cout << Robot_type << ": " << "X: " << X << " Y: " << Y << std::endl;
+    }
+
+    void set_position(double x, double y){
+        X = x;
+        Y = y;
+    }
+    double get_X_position(){
+        return X;
+    }
+    double get_Y_position(){
+        return Y;
+    }
+    point(string robot_type, double x , double y) {
+        Robot_type = robot_type;
+        X = x;
+        Y = y;
+    }
+};
+
+/**
+ * @class Employee
+ * @brief Employee from oop_trainer.cpp
+ */
+class Employee{
+protected:
+    string Name;     ///< Employee's name
+    string Company;  ///< Company where employee works
+    int Age;         ///< Employee's age
+
+public:
+    void setName(string name){
+        Name = name;
+    }
+    string getName(){
+        return Name;
+    }
+    string getCompany(){
+        return Company;
+    }
+    int getAge(){
+        return Age;
+    }
+
+    virtual void introduce_yourself(){
+        std::cout << "Name - " << Name << std::endl;
+        std::cout << "Company - " << Company << std::endl;
+        std::cout << "Age - " << Age << std::endl;
+    }
+
+    Employee(string name, string company, int age){
+        Name = name;
+        Company = company;
+        Age = age;
+    }
+
+    virtual ~Employee() = default;
+};
+
+/**
+ * @struct NumaNode
+ * @brief One NUMA node and the CPUs of it this process may run on
+ */
+struct NumaNode{
+    int Id;
+    std::vector<int> Cpus;
+};
+
+/**
+ * @brief Parse a sysfs CPU list such as "0-3,8,10-11"
+ */
+static std::vector<int> parse_cpulist(const string& list){
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    string range;
+    while (std::getline(ss, range, ',')){
+        if (range.empty() || range == "\n") continue;
+        size_t dash = range.find('-');
+        int lo = std::atoi(range.c_str());
+        int hi = dash == string::npos ? lo : std::atoi(range.c_str() + dash + 1);
+        for (int c = lo; c <= hi; c++) cpus.push_back(c);
+    }
+    return cpus;
+}
+
+/**
+ * @brief Discover NUMA nodes from /sys/devices/system/node
+ * @return At least one node; without NUMA information a single node 0
+ *         holding every CPU this process may use
+ */
+static std::vector<NumaNode> detect_numa_nodes(){
+    std::vector<NumaNode> nodes;
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool have_mask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    if (DIR* dir = opendir("/sys/devices/system/node")){
+        while (dirent* entry = readdir(dir)){
+            if (std::strncmp(entry->d_name, "node", 4) != 0 || !std::isdigit((unsigned char)entry->d_name[4])) continue;
+            std::ifstream in(string("/sys/devices/system/node/") + entry->d_name + "/cpulist");
+            string list;
+            std::getline(in, list);
+            NumaNode node{std::atoi(entry->d_name + 4), {}};
+            for (int cpu : parse_cpulist(list)){
+                if (!have_mask || CPU_ISSET(cpu, &allowed)) node.Cpus.push_back(cpu);
+            }
+            if (!node.Cpus.empty()) nodes.push_back(node);
+        }
+        closedir(dir);
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const NumaNode& a, const NumaNode& b){ return a.Id < b.Id; });
+    if (nodes.empty() && have_mask){
+        NumaNode node{0, {}};
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++){
+            if (CPU_ISSET(cpu, &allowed)) node.Cpus.push_back(cpu);
+        }
+        if (!node.Cpus.empty()) nodes.push_back(node);
+    }
+#endif
+    if (nodes.empty()){
+        NumaNode node{0, {}};
+        for (unsigned cpu = 0; cpu < std::max(std::thread::hardware_concurrency(), 1u); cpu++){
+            node.Cpus.push_back(int(cpu));
+        }
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
+/**
+ * @class PinnedWorkers
+ * @brief A fixed set of workers, each always run on the same CPU
+ *
+ * Workers are dealt round-robin over the NUMA nodes, so worker w sits on
+ * node w % nodes. Because worker w is pinned to the same CPU on every
+ * run(), the memory it first-touched stays local to it.
+ */
+class PinnedWorkers{
+public:
+    PinnedWorkers(const std::vector<NumaNode>& nodes, unsigned workers){
+        size_t total = 0;
+        for (const NumaNode& n : nodes) total += n.Cpus.size();
+        workers = std::max(1u, workers == 0 ? unsigned(total) : workers);
+        std::vector<size_t> next(nodes.size(), 0);
+        for (unsigned w = 0; w < workers; w++){
+            size_t n = w % nodes.size();
+            const NumaNode& node = nodes[n];
+            Cpus.push_back(node.Cpus[next[n]++ % node.Cpus.size()]);
+            Nodes.push_back(node.Id);
+        }
+    }
+
+    unsigned size() const { return unsigned(Cpus.size()); }
+    int cpu_of(unsigned worker) const { return Cpus[worker]; }
+    int node_of(unsigned worker) const { return Nodes[worker]; }
+
+    /**
+     * @brief Run fn(worker) on every worker, each pinned to its CPU, and wait for all
+     */
+    template <typename Fn>
+    void run(Fn fn) const {
+        std::vector<std::thread> pool;
+        for (unsigned w = 0; w < size(); w++){
+            pool.emplace_back([this, &fn, w]{
+                pin(Cpus[w]);
+                fn(w);
+            });
+        }
+        for (std::thread& t : pool) t.join();
+    }
+
+private:
+    /// Pinning is best effort: a container may refuse it, the work still runs
+    static void pin(int cpu){
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+#else
+        (void)cpu;
+#endif
+    }
+
+    std::vector<int> Cpus;
+    std::vector<int> Nodes;
+};
+
+enum class PageMode { Normal, Transparent, Explicit };
+
+static const char* page_mode_name(PageMode mode){
+    switch (mode){
+        case PageMode::Normal:      return "4K pages";
+        case PageMode::Transparent: return "transparent huge pages";
+        case PageMode::Explicit:    return "explicit huge pages";
+    }
+    return "?";
+}
+
+/**
+ * @class LargeBuffer
+ * @brief Anonymous mmap, optionally backed by huge pages; memory is not touched here
+ *
+ * Explicit asks the kernel for MAP_HUGETLB pages from the reserved pool
+ * (vm.nr_hugepages). If none are reserved it falls back to Transparent,
+ * which maps normally and asks for huge pages with madvise(MADV_HUGEPAGE).
+ * mode() reports what was actually obtained.
+ */
+class LargeBuffer{
+public:
+    static constexpr size_t HugePage = size_t(2) << 20;
+
+    LargeBuffer(size_t bytes, PageMode mode){
+        Bytes = std::max<size_t>((bytes + HugePage - 1) / HugePage * HugePage, HugePage);
+        Mode = mode;
+#ifdef MAP_HUGETLB
+        if (Mode == PageMode::Explicit){
+            Data = mmap(nullptr, Bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (Data == MAP_FAILED){
+                Data = nullptr;
+                Mode = PageMode::Transparent;
+            }
+        }
+#else
+        if (Mode == PageMode::Explicit) Mode = PageMode::Transparent;
+#endif
+        if (Data == nullptr){
+            // Plain mmap only promises 4K alignment: over-map by one huge page,
+            // align the start up and give the slack back, so huge pages and
+            // page-aligned partitions line up on any kernel
+            size_t mapped = Bytes + HugePage;
+            void* raw = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) throw std::bad_alloc();
+            uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+            uintptr_t aligned = (start + HugePage - 1) / HugePage * HugePage;
+            if (aligned > start) munmap(raw, aligned - start);
+            size_t tail = mapped - (aligned - start) - Bytes;
+            if (tail > 0) munmap(reinterpret_cast<void*>(aligned + Bytes), tail);
+            Data = reinterpret_cast<void*>(aligned);
+        }
+#ifdef MADV_NOHUGEPAGE
+        // Keep the 4K baseline honest on systems where THP is "always"
+        if (Mode == PageMode::Normal) madvise(Data, Bytes, MADV_NOHUGEPAGE);
+#endif
+        if (Mode == PageMode::Transparent){
+#ifdef MADV_HUGEPAGE
+            if (madvise(Data, Bytes, MADV_HUGEPAGE) != 0) Mode = PageMode::Normal;
+#else
+            Mode = PageMode::Normal;
+#endif
+        }
+    }
+
+    ~LargeBuffer(){
+        if (Data != nullptr) munmap(Data, Bytes);
+    }
+
+    LargeBuffer(const LargeBuffer&) = delete;
+    LargeBuffer& operator=(const LargeBuffer&) = delete;
+
+    void* data() const { return Data; }
+    size_t bytes() const { return Bytes; }
+    PageMode mode() const { return Mode; }
+    size_t page_size() const { return Mode == PageMode::Normal ? 4096 : HugePage; }
+
+private:
+    void* Data = nullptr;
+    size_t Bytes = 0;
+    PageMode Mode;
+};
+
+/**
+ * @class NumaTable
+ * @brief Fixed-size array of T split into one partition per pinned worker
+ *
+ * Each worker constructs the elements of its own partition, so under the
+ * kernel's default first-touch policy those pages are allocated on that
+ * worker's node. Partition bounds are multiples of lcm(page, sizeof(T))
+ * bytes from the page-aligned start of the buffer, so every partition
+ * begins on a page boundary and no page is shared between two workers.
+ * Process the table with for_each_partition() to keep every worker on its
+ * local memory.
+ */
+template <typename T>
+class NumaTable{
+public:
+    /**
+     * @brief Allocate and first-touch the table
+     * @param make Called as make(i) on the owning worker to build element i
+     */
+    template <typename Make>
+    NumaTable(const PinnedWorkers& workers, size_t count, PageMode mode, Make make):
+        Workers(workers),
+        Buffer(count * sizeof(T), mode),
+        Count(count){
+        // Smallest element count that is a whole number of pages
+        size_t granule = std::lcm(Buffer.page_size(), sizeof(T)) / sizeof(T);
+        size_t chunk = (count + workers.size() - 1) / workers.size();
+        chunk = (chunk + granule - 1) / granule * granule;
+        for (unsigned w = 0; w <= workers.size(); w++){
+            Bounds.push_back(std::min(count, size_t(w) * chunk));
+        }
+
+        T* items = data();
+        Workers.run([this, items, &make](unsigned w){
+            for (size_t i = Bounds[w]; i < Bounds[w + 1]; i++) new (items + i) T(make(i));
+        });
+    }
+
+    ~NumaTable(){
+        T* items = data();
+        Workers.run([this, items](unsigned w){
+            for (size_t i = Bounds[w]; i < Bounds[w + 1]; i++) items[i].~T();
+        });
+    }
+
+    NumaTable(const NumaTable&) = delete;
+    NumaTable& operator=(const NumaTable&) = delete;
+
+    T& operator[](size_t i){ return data()[i]; }
+    size_t size() const { return Count; }
+    PageMode mode() const { return Buffer.mode(); }
+
+    /**
+     * @brief Run fn(worker, begin, end) on every worker over its own partition
+     */
+    template <typename Fn>
+    void for_each_partition(Fn fn){
+        T* items = data();
+        Workers.run([this, items, &fn](unsigned w){
+            fn(w, items + Bounds[w], items + Bounds[w + 1]);
+        });
+    }
+
+private:
+    T* data() const { return static_cast<T*>(Buffer.data()); }
+
+    const PinnedWorkers& Workers;
+    LargeBuffer Buffer;
+    size_t Count;
+    std::vector<size_t> Bounds;  ///< Worker w owns [Bounds[w], Bounds[w + 1])
+};
+
+/**
+ * @class PerfCounter
+ * @brief dTLB load-miss counter for the calling thread via perf_event_open
+ */
+class PerfCounter{
+public:
+    PerfCounter(){
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        Fd = int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    ~PerfCounter(){
+#ifdef __linux__
+        if (Fd >= 0) close(Fd);
+#endif
+    }
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    bool valid() const { return Fd >= 0; }
+
+    void start(){
+#ifdef __linux__
+        if (Fd < 0) return;
+        ioctl(Fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(Fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    /// @return Misses since start(), 0 if the counter is unavailable
+    uint64_t stop(){
+        uint64_t count = 0;
+#ifdef __linux__
+        if (Fd < 0) return 0;
+        ioctl(Fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(Fd, &count, sizeof(count)) != ssize_t(sizeof(count))) count = 0;
+#endif
+        return count;
+    }
+
+private:
+    int Fd = -1;
+};
+
+/**
+ * @brief AnonHugePages of this process in kB, -1 if the kernel doesn't say
+ */
+static long anon_huge_kb(){
+    std::ifstream in("/proc/self/smaps_rollup");
+    string line;
+    while (std::getline(in, line)){
+        if (line.rfind("AnonHugePages:", 0) == 0) return std::atol(line.c_str() + 14);
+    }
+    return -1;
+}
+
+using Clock = std::chrono::steady_clock;
+
+static double seconds_since(Clock::time_point start){
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// Per-worker results, padded so workers don't false-share
+struct alignas(64) WorkerStats{
+    uint64_t Misses = 0;
+    uint64_t Ops = 0;
+    double Checksum = 0;
+    bool Counted = false;
+};
+
+static void report(const char* label, double secs, const std::vector<WorkerStats>& stats){
+    uint64_t ops = 0, misses = 0;
+    bool counted = true;
+    for (const WorkerStats& s : stats){
+        ops += s.Ops;
+        misses += s.Misses;
+        counted = counted && s.Counted;
+    }
+    std::cout << "    " << label << ": " << double(ops) / secs / 1e6 << " M ops/s, dTLB misses per op: ";
+    if (counted) std::cout << double(misses) / double(std::max<uint64_t>(ops, 1)) << "\n";
+    else std::cout << "n/a\n";
+}
+
+/**
+ * @brief Sequential update pass and local random-gather pass over a point table
+ */
+static void bench_points(const PinnedWorkers& workers, size_t count, size_t passes, PageMode mode){
+    auto start = Clock::now();
+    NumaTable<point> fleet(workers, count, mode, [](size_t i){
+        return point("Auto_car", double(i), 0.0);
+    });
+    double touch = seconds_since(start);
+    std::cout << "  points, " << page_mode_name(fleet.mode()) << ": first touch " << touch * 1e3
+              << " ms, AnonHugePages " << anon_huge_kb() << " kB\n";
+
+    std::vector<WorkerStats> stats(workers.size());
+    start = Clock::now();
+    fleet.for_each_partition([&stats, passes](unsigned w, point* begin, point* end){
+        PerfCounter tlb;
+        tlb.start();
+        for (size_t p = 0; p < passes; p++){
+            for (point* r = begin; r != end; r++) r->set_position(r->get_X_position() + 1.0, r->get_Y_position() - 1.0);
+        }
+        stats[w].Misses = tlb.stop();
+        stats[w].Counted = tlb.valid();
+        stats[w].Ops = size_t(end - begin) * passes;
+    });
+    report("sequential update", seconds_since(start), stats);
+
+    stats.assign(workers.size(), WorkerStats{});
+    start = Clock::now();
+    fleet.for_each_partition([&stats, passes](unsigned w, point* begin, point* end){
+        size_t n = size_t(end - begin);
+        if (n == 0) return;
+        uint64_t x = 0x9e3779b97f4a7c15ULL + w;
+        double sum = 0;
+        PerfCounter tlb;
+        tlb.start();
+        for (size_t k = 0; k < n * passes; k++){
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;  // xorshift64
+            sum += begin[x % n].get_X_position();
+        }
+        stats[w].Misses = tlb.stop();
+        stats[w].Counted = tlb.valid();
+        stats[w].Ops = n * passes;
+        stats[w].Checksum = sum;
+    });
+    report("random gather    ", seconds_since(start), stats);
+}
+
+/**
+ * @brief Promotion scan over an Employee roster
+ */
+static void bench_employees(const PinnedWorkers& workers, size_t count, size_t passes, PageMode mode){
+    static const char* const companies[] = {"UTM", "UKT", "EEE", "WEW"};
+    auto start = Clock::now();
+    NumaTable<Employee> roster(workers, count, mode, [](size_t i){
+        return Employee("emp" + std::to_string(i), companies[i % 4], int(20 + i % 45));
+    });
+    double touch = seconds_since(start);
+    std::cout << "  employees, " << page_mode_name(roster.mode()) << ": first touch " << touch * 1e3 << " ms\n";
+
+    std::vector<WorkerStats> stats(workers.size());
+    start = Clock::now();
+    roster.for_each_partition([&stats, passes](unsigned w, Employee* begin, Employee* end){
+        PerfCounter tlb;
+        tlb.start();
+        uint64_t promoted = 0;
+        for (size_t p = 0; p < passes; p++){
+            for (Employee* e = begin; e != end; e++) promoted += e->getAge() > 40;
+        }
+        stats[w].Misses = tlb.stop();
+        stats[w].Counted = tlb.valid();
+        stats[w].Ops = size_t(end - begin) * passes;
+        stats[w].Checksum = double(promoted);
+    });
+    report("promotion scan   ", seconds_since(start), stats);
+    if (roster.size() > 0) roster[0].introduce_yourself();
+}
+
+/**
+ * @brief Main function - runs every benchmark with 4K, transparent and explicit huge pages
+ * @return 0 on successful execution
+ */
+int main(int argc, char** argv){
+    size_t points = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8'000'000;
+    size_t employees = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2'000'000;
+    size_t passes = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 4;
+    unsigned requested = argc > 4 ? unsigned(std::strtoul(argv[4], nullptr, 10)) : 0;
+
+    std::vector<NumaNode> nodes = detect_numa_nodes();
+    PinnedWorkers workers(nodes, requested);
+    std::cout << nodes.size() << " NUMA node(s), " << workers.size() << " worker(s):";
+    for (unsigned w = 0; w < workers.size(); w++){
+        std::cout << " w" << w << "->cpu" << workers.cpu_of(w) << "/node" << workers.node_of(w);
+    }
+    std::cout << "\n";
+
+    for (PageMode mode : {PageMode::Normal, PageMode::Transparent, PageMode::Explicit}){
+        std::cout << "requested " << page_mode_name(mode) << "\n";
+        bench_points(workers, points, passes, mode);
+        bench_employees(workers, employees, passes, mode);
+    }
+
+    return 0;
+}
+
+/**
+ * HUGE PAGE NOTES:
+ * ---------------
+ * 1. A TLB entry maps one page; with 2 MB pages one entry covers 512 times
+ *    as much table as with 4 KB pages
+ * 2. Transparent huge pages: the kernel promotes 2 MB-aligned regions on its
+ *    own, madvise(MADV_HUGEPAGE) asks for it when the system is in "madvise" mode
+ * 3. Explicit huge pages come from a pool reserved up front
+ *    (echo N > /proc/sys/vm/nr_hugepages) and are never swapped or split
+ *
+ * NUMA NOTES:
+ * ----------
+ * - Linux places an anonymous page on the node of the CPU that first writes it
+ * - So: pin the worker first, let it build its own partition, and keep giving
+ *   it that same partition afterwards
+ * - Strings inside point/Employee that don't fit the small-string buffer get
+ *   their own heap allocation, made by the same pinned worker, so they
+ *   end up node-local as well
+ */
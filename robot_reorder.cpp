@@ -0,0 +1,612 @@
+/**
+ * @file robot_reorder.cpp
+ * @brief Space-filling-curve (Morton/Hilbert) reordering of robot storage
+ *
+ * corrdinates.cpp keeps robots in construction order, so robots that are
+ * close to each other in space are usually far apart in memory and a
+ * neighborhood sweep jumps all over the fleet. SpatialFleet sorts its
+ * storage by the Morton or Hilbert key of each robot's (X, Y[, Z]) so that
+ * spatial neighbors end up in neighboring slots, while a stable ID -> slot
+ * table lets callers keep addressing robots by ID.
+ *
+ * reorder() is a full parallel sort. resort() is the cheap pass to run as
+ * robots drift: it keeps the robots that are still in key order where they
+ * are, sorts only the ones that fell out of order and merges them back.
+ *
+ * Build: g++ -std=c++17 -O2 -pthread robot_reorder.cpp -o output/robot_reorder
+ * Usage: ./output/robot_reorder [robots] [workers]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+/**
+ * @class point
+ * @brief 2D robot position, same interface as in corrdinates.cpp
+ */
+class point{
+
+    protected:
+        double X , Y;
+    public:
+        string Robot_type;
+    void print_position(){
+        std::cout << Robot_type << ": " << "X: " << X << " Y: " << Y << std::endl;
+    }
+
+    void set_position(double x, double y){
+        X = x;
+        Y = y;
+    }
+    double get_X_position(){
+        return X;
+    }
+    double get_Y_position(){
+        return Y;
+    }
+    point(string robot_type, double x , double y) {
+        Robot_type = robot_type;
+        X = x;
+        Y = y;
+    }
+};
+
+/**
+ * @class point3D
+ * @brief 3D robot position, same interface as in corrdinates.cpp
+ */
+class point3D:public point{
+
+    public:
+        double Z;
+
+        point3D(string robot_type,double x, double y, double z):point(robot_type,x, y){
+            Z = z;
+        }
+
+    void print_position3D(){
+        std::cout << Robot_type << ": " << " X: " << get_X_position() << " Y: " << get_Y_position() << " Z: " << Z << std::endl;
+    }
+};
+
+/**
+ * @brief Split [0, n) into one contiguous range per worker and run fn(begin, end) on each
+ */
+template <typename Fn>
+static void parallel_for(size_t n, unsigned workers, Fn fn){
+    workers = std::max(1u, std::min<unsigned>(workers, unsigned(std::max<size_t>(n / 4096, 1))));
+    std::vector<std::thread> pool;
+    size_t chunk = (n + workers - 1) / workers;
+    for (unsigned w = 1; w < workers; w++){
+        size_t begin = std::min(n, w * chunk), end = std::min(n, begin + chunk);
+        pool.emplace_back(fn, begin, end);
+    }
+    fn(size_t(0), std::min(n, chunk));
+    for (std::thread& t : pool) t.join();
+}
+
+/**
+ * @brief Sort in parallel: each worker sorts one run, then runs are merged pairwise
+ */
+template <typename T>
+static void parallel_sort(std::vector<T>& items, unsigned workers){
+    workers = std::max(1u, std::min<unsigned>(workers, unsigned(std::max<size_t>(items.size() / 16384, 1))));
+    size_t chunk = (items.size() + workers - 1) / workers;
+    std::vector<size_t> bounds;
+    for (size_t b = 0; b < items.size(); b += chunk) bounds.push_back(b);
+    bounds.push_back(items.size());
+
+    std::vector<std::thread> pool;
+    for (size_t r = 0; r + 1 < bounds.size(); r++){
+        pool.emplace_back([&items, &bounds, r]{
+            std::sort(items.begin() + bounds[r], items.begin() + bounds[r + 1]);
+        });
+    }
+    for (std::thread& t : pool) t.join();
+
+    while (bounds.size() > 2){
+        std::vector<size_t> next;
+        pool.clear();
+        size_t r = 0;
+        for (; r + 2 < bounds.size(); r += 2){
+            size_t lo = bounds[r], mid = bounds[r + 1], hi = bounds[r + 2];
+            pool.emplace_back([&items, lo, mid, hi]{
+                std::inplace_merge(items.begin() + lo, items.begin() + mid, items.begin() + hi);
+            });
+            next.push_back(lo);
+        }
+        if (r + 1 < bounds.size()) next.push_back(bounds[r]);  // Odd run out waits for the next round
+        next.push_back(items.size());
+        for (std::thread& t : pool) t.join();
+        bounds = std::move(next);
+    }
+}
+
+/// Spread the low 32 bits so there is a zero bit between each of them
+static uint64_t part1by1(uint64_t v){
+    v &= 0xffffffffULL;
+    v = (v | (v << 16)) & 0x0000ffff0000ffffULL;
+    v = (v | (v << 8))  & 0x00ff00ff00ff00ffULL;
+    v = (v | (v << 4))  & 0x0f0f0f0f0f0f0f0fULL;
+    v = (v | (v << 2))  & 0x3333333333333333ULL;
+    v = (v | (v << 1))  & 0x5555555555555555ULL;
+    return v;
+}
+
+/// Spread the low 21 bits so there are two zero bits between each of them
+static uint64_t part1by2(uint64_t v){
+    v &= 0x1fffffULL;
+    v = (v | (v << 32)) & 0x001f00000000ffffULL;
+    v = (v | (v << 16)) & 0x001f0000ff0000ffULL;
+    v = (v | (v << 8))  & 0x100f00f00f00f00fULL;
+    v = (v | (v << 4))  & 0x10c30c30c30c30c3ULL;
+    v = (v | (v << 2))  & 0x1249249249249249ULL;
+    return v;
+}
+
+static uint64_t morton2D(uint32_t x, uint32_t y){
+    return part1by1(x) | (part1by1(y) << 1);
+}
+
+static uint64_t morton3D(uint32_t x, uint32_t y, uint32_t z){
+    return part1by2(x) | (part1by2(y) << 1) | (part1by2(z) << 2);
+}
+
+/**
+ * @brief Distance along a 2D Hilbert curve over a (2^order) x (2^order) grid
+ */
+static uint64_t hilbert2D(uint32_t x, uint32_t y, unsigned order){
+    const uint32_t n = uint32_t(1) << order;
+    uint64_t d = 0;
+    for (uint32_t s = n / 2; s > 0; s /= 2){
+        uint32_t rx = (x & s) > 0;
+        uint32_t ry = (y & s) > 0;
+        d += uint64_t(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0){  // Rotate the quadrant so the curve stays continuous
+            if (rx == 1){
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+/**
+ * @brief Distance along a 3D Hilbert curve over a (2^order)^3 grid
+ *
+ * Skilling's method ("Programming the Hilbert curve", 2004): undo the
+ * per-level rotations in place, Gray-decode, then interleave the bits with
+ * X as the most significant axis. Like the 2D curve, dropping the low 3*k
+ * bits gives the index of the enclosing cell on the 2^k times coarser grid.
+ */
+static uint64_t hilbert3D(uint32_t x, uint32_t y, uint32_t z, unsigned order){
+    uint32_t axes[3] = {x, y, z};
+    const uint32_t top = uint32_t(1) << (order - 1);
+    for (uint32_t q = top; q > 1; q >>= 1){
+        uint32_t low = q - 1;
+        for (int i = 0; i < 3; i++){
+            if (axes[i] & q){
+                axes[0] ^= low;
+            }
+            else{
+                uint32_t t = (axes[0] ^ axes[i]) & low;
+                axes[0] ^= t;
+                axes[i] ^= t;
+            }
+        }
+    }
+    for (int i = 1; i < 3; i++) axes[i] ^= axes[i - 1];
+    uint32_t t = 0;
+    for (uint32_t q = top; q > 1; q >>= 1){
+        if (axes[2] & q) t ^= q - 1;
+    }
+    for (int i = 0; i < 3; i++) axes[i] ^= t;
+
+    uint64_t d = 0;
+    for (int bit = int(order) - 1; bit >= 0; bit--){
+        for (int i = 0; i < 3; i++) d = (d << 1) | ((axes[i] >> bit) & 1);
+    }
+    return d;
+}
+
+enum class Curve { Morton, Hilbert };
+
+static const char* curve_name(Curve curve){
+    return curve == Curve::Hilbert ? "Hilbert" : "Morton";
+}
+
+/**
+ * @class SpatialFleet
+ * @brief Robot storage kept in space-filling-curve order
+ *
+ * Robots get a permanent ID when added. Robots[] is the storage in curve
+ * order, Id_of[slot] and Slot_of[id] translate between the two.
+ *
+ * Positions are quantised onto a 2^21 grid per axis over the bounding box
+ * taken at the last reorder(); robots that drift outside it are clamped to
+ * the edge, which only costs locality until the next full reorder().
+ * Both curves work in 2D and 3D (use_z = true).
+ */
+class SpatialFleet{
+public:
+    static constexpr unsigned GridBits = 21;
+
+    SpatialFleet(Curve curve, bool use_z, unsigned workers):
+        Kind(curve),
+        Use_z(use_z),
+        Workers(std::max(workers, 1u)){
+    }
+
+    /**
+     * @brief Append a robot, it keeps its slot until the next reorder()/resort()
+     * @return The robot's permanent ID
+     */
+    uint32_t add(point3D robot){
+        uint32_t id = uint32_t(Robots.size());
+        Robots.push_back(std::move(robot));
+        Id_of.push_back(id);
+        Slot_of.push_back(id);
+        return id;
+    }
+
+    point3D& robot(uint32_t id){ return Robots[Slot_of[id]]; }
+    point3D& at_slot(size_t slot){ return Robots[slot]; }
+    uint32_t id_at(size_t slot) const { return Id_of[slot]; }
+    uint32_t slot_of(uint32_t id) const { return Slot_of[id]; }
+    size_t size() const { return Robots.size(); }
+    Curve curve() const { return Kind; }
+    bool uses_z() const { return Use_z; }
+
+    /**
+     * @brief Recompute the bounding box and fully re-sort the fleet by curve key
+     */
+    void reorder(){
+        compute_bounds();
+        std::vector<std::pair<uint64_t, uint32_t>> keyed(Robots.size());
+        parallel_for(Robots.size(), Workers, [this, &keyed](size_t begin, size_t end){
+            for (size_t s = begin; s < end; s++) keyed[s] = {key_of(Robots[s]), uint32_t(s)};
+        });
+        parallel_sort(keyed, Workers);
+        for (auto& k : keyed) k.first >>= Coarse_shift;  // Still sorted, and comparable with resort()
+        apply(keyed);
+    }
+
+    /**
+     * @brief Restore curve order after robots drifted
+     * @return Number of robots that had to move, or size() if it fell back to reorder()
+     *
+     * Keys are compared on a coarse grid of about four robots per cell, so
+     * robots that only jiggle inside their cell don't count as moved. Robots
+     * whose cell is unchanged since the last sort are still in order relative
+     * to each other and stay put; the others (including robots added since)
+     * are sorted on their own, O(d log d) for d drifters, and merged back in
+     * one linear pass. Past a quarter of the fleet a full reorder() is cheaper.
+     */
+    size_t resort(){
+        const size_t n = Robots.size();
+        if (!Has_bounds){
+            reorder();
+            return n;
+        }
+        std::vector<uint64_t> keys(n);
+        parallel_for(n, Workers, [this, &keys](size_t begin, size_t end){
+            for (size_t s = begin; s < end; s++) keys[s] = key_of(Robots[s]) >> Coarse_shift;
+        });
+
+        std::vector<std::pair<uint64_t, uint32_t>> kept, drifters;
+        kept.reserve(n);
+        for (size_t s = 0; s < n; s++){
+            if (s < Cell_keys.size() && keys[s] == Cell_keys[s]) kept.push_back({keys[s], uint32_t(s)});
+            else drifters.push_back({keys[s], uint32_t(s)});
+        }
+        if (drifters.empty()) return 0;
+        if (drifters.size() > n / 4){
+            reorder();
+            return n;
+        }
+
+        std::sort(drifters.begin(), drifters.end());
+        std::vector<std::pair<uint64_t, uint32_t>> merged(n);
+        std::merge(kept.begin(), kept.end(), drifters.begin(), drifters.end(), merged.begin());
+        apply(merged);
+        return drifters.size();
+    }
+
+private:
+    void compute_bounds(){
+        double lo[3] = {1e300, 1e300, 1e300}, hi[3] = {-1e300, -1e300, -1e300};
+        for (point3D& r : Robots){
+            double p[3] = {r.get_X_position(), r.get_Y_position(), r.Z};
+            for (int a = 0; a < 3; a++){
+                lo[a] = std::min(lo[a], p[a]);
+                hi[a] = std::max(hi[a], p[a]);
+            }
+        }
+        const double cells = double((uint32_t(1) << GridBits) - 1);
+        for (int a = 0; a < 3; a++){
+            Min[a] = lo[a];
+            Scale[a] = hi[a] > lo[a] ? cells / (hi[a] - lo[a]) : 0.0;
+        }
+        Has_bounds = true;
+
+        // Bits per axis for a grid with about 4 robots per cell, see resort()
+        const unsigned dims = Use_z ? 3 : 2;
+        unsigned level = 0;
+        while (level < GridBits && (uint64_t(1) << (dims * (level + 1))) <= std::max<size_t>(Robots.size() / 4, 1)){
+            level++;
+        }
+        Coarse_shift = dims * (GridBits - level);
+    }
+
+    uint32_t quantise(double v, int axis) const {
+        double q = (v - Min[axis]) * Scale[axis];
+        const double top = double((uint32_t(1) << GridBits) - 1);
+        return uint32_t(std::clamp(q, 0.0, top));
+    }
+
+    uint64_t key_of(point3D& r) const {
+        uint32_t x = quantise(r.get_X_position(), 0);
+        uint32_t y = quantise(r.get_Y_position(), 1);
+        if (Use_z){
+            uint32_t z = quantise(r.Z, 2);
+            return Kind == Curve::Hilbert ? hilbert3D(x, y, z, GridBits) : morton3D(x, y, z);
+        }
+        return Kind == Curve::Hilbert ? hilbert2D(x, y, GridBits) : morton2D(x, y);
+    }
+
+    /// Rebuild storage so new slot i holds the robot from old slot order[i].second, with coarse key order[i].first
+    void apply(const std::vector<std::pair<uint64_t, uint32_t>>& order){
+        std::vector<point3D> next;
+        next.reserve(Robots.size());
+        std::vector<uint32_t> next_id(Robots.size());
+        Cell_keys.resize(Robots.size());
+        for (size_t s = 0; s < order.size(); s++){
+            uint32_t old = order[s].second;
+            Cell_keys[s] = order[s].first;
+            next.push_back(std::move(Robots[old]));
+            next_id[s] = Id_of[old];
+            Slot_of[next_id[s]] = uint32_t(s);
+        }
+        Robots = std::move(next);
+        Id_of = std::move(next_id);
+    }
+
+    const Curve Kind;
+    const bool Use_z;
+    const unsigned Workers;
+    std::vector<point3D> Robots;   ///< Storage, in curve order after a reorder
+    std::vector<uint32_t> Id_of;   ///< slot -> ID
+    std::vector<uint32_t> Slot_of; ///< ID -> slot
+    bool Has_bounds = false;
+    unsigned Coarse_shift = 0;     ///< Curve key bits below the resort() grid
+    std::vector<uint64_t> Cell_keys; ///< slot -> coarse key at the last sort
+    double Min[3] = {0, 0, 0};
+    double Scale[3] = {0, 0, 0};
+};
+
+/**
+ * @class PerfCounter
+ * @brief Hardware cache-miss counter via perf_event_open, when the kernel allows it
+ */
+class PerfCounter{
+public:
+    PerfCounter(){
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        Fd = int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    ~PerfCounter(){
+#ifdef __linux__
+        if (Fd >= 0) close(Fd);
+#endif
+    }
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    bool valid() const { return Fd >= 0; }
+
+    void start(){
+#ifdef __linux__
+        if (Fd < 0) return;
+        ioctl(Fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(Fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    /// @return Cache misses since start(), 0 if the counter is unavailable
+    uint64_t stop(){
+        uint64_t count = 0;
+#ifdef __linux__
+        if (Fd < 0) return 0;
+        ioctl(Fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(Fd, &count, sizeof(count)) != ssize_t(sizeof(count))) count = 0;
+#endif
+        return count;
+    }
+
+private:
+    int Fd = -1;
+};
+
+/**
+ * @brief For every robot, count the robots within `radius` on the X/Y plane
+ *
+ * Uses a uniform grid of radius-sized cells, filled in slot order, and then
+ * visits the robots in slot order - so the memory access pattern follows
+ * whatever order the fleet is stored in.
+ */
+static size_t neighbor_sweep(SpatialFleet& fleet, double radius, double side){
+    const size_t n = fleet.size();
+    const size_t cells_per_axis = std::max<size_t>(size_t(side / radius), 1);
+    auto cell_of = [cells_per_axis, radius](double v){
+        return std::min(cells_per_axis - 1, size_t(std::max(v, 0.0) / radius));
+    };
+
+    // Counting sort of slots by cell
+    std::vector<uint32_t> cell_start(cells_per_axis * cells_per_axis + 1, 0);
+    std::vector<uint32_t> cell_items(n);
+    std::vector<uint32_t> robot_cell(n);
+    for (size_t s = 0; s < n; s++){
+        point3D& r = fleet.at_slot(s);
+        robot_cell[s] = uint32_t(cell_of(r.get_Y_position()) * cells_per_axis + cell_of(r.get_X_position()));
+        cell_start[robot_cell[s] + 1]++;
+    }
+    for (size_t c = 1; c < cell_start.size(); c++) cell_start[c] += cell_start[c - 1];
+    std::vector<uint32_t> fill(cell_start.begin(), cell_start.end() - 1);
+    for (size_t s = 0; s < n; s++) cell_items[fill[robot_cell[s]]++] = uint32_t(s);
+
+    size_t pairs = 0;
+    const double r2 = radius * radius;
+    for (size_t s = 0; s < n; s++){
+        point3D& r = fleet.at_slot(s);
+        double x = r.get_X_position(), y = r.get_Y_position();
+        long cx = long(robot_cell[s] % cells_per_axis), cy = long(robot_cell[s] / cells_per_axis);
+        for (long ny = std::max(cy - 1, 0L); ny <= std::min(cy + 1, long(cells_per_axis) - 1); ny++){
+            for (long nx = std::max(cx - 1, 0L); nx <= std::min(cx + 1, long(cells_per_axis) - 1); nx++){
+                size_t c = size_t(ny) * cells_per_axis + size_t(nx);
+                for (uint32_t i = cell_start[c]; i < cell_start[c + 1]; i++){
+                    point3D& o = fleet.at_slot(cell_items[i]);
+                    double dx = o.get_X_position() - x, dy = o.get_Y_position() - y;
+                    if (dx * dx + dy * dy <= r2) pairs++;
+                }
+            }
+        }
+    }
+    return pairs - n;  // Every robot found itself
+}
+
+using Clock = std::chrono::steady_clock;
+
+static double seconds_since(Clock::time_point start){
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void report_sweep(const char* label, SpatialFleet& fleet, double radius, double side){
+    PerfCounter misses;
+    misses.start();
+    auto start = Clock::now();
+    size_t pairs = neighbor_sweep(fleet, radius, side);
+    double secs = seconds_since(start);
+    uint64_t count = misses.stop();
+
+    std::cout << "  " << label << ": " << secs * 1e3 << " ms, " << pairs << " neighbor pairs, cache misses: ";
+    if (misses.valid()) std::cout << count << "\n";
+    else std::cout << "n/a\n";
+}
+
+/**
+ * @brief Build a fleet in random order, then time neighbor sweeps before and after reordering
+ */
+static void bench_curve(Curve curve, size_t robots, unsigned workers){
+    // About 8 neighbors per robot within radius 1
+    const double radius = 1.0;
+    const double side = std::sqrt(double(robots) * 3.14159 / 8.0);
+
+    SpatialFleet fleet(curve, false, workers);
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> coord(0.0, side);
+    for (size_t i = 0; i < robots; i++){
+        fleet.add(point3D("Auto_car", coord(rng), coord(rng), 0.0));
+    }
+
+    std::cout << curve_name(fleet.curve()) << " order, " << robots << " robots, " << workers << " workers\n";
+    report_sweep("construction order", fleet, radius, side);
+
+    auto start = Clock::now();
+    fleet.reorder();
+    std::cout << "  full reorder: " << seconds_since(start) * 1e3 << " ms\n";
+    report_sweep("curve order       ", fleet, radius, side);
+
+    // Drift: every robot moves a little, 1% jump across the map
+    std::normal_distribution<double> jitter(0.0, 0.05);
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (size_t id = 0; id < robots; id++){
+        point3D& r = fleet.robot(uint32_t(id));
+        if (percent(rng) == 0) r.set_position(coord(rng), coord(rng));
+        else r.set_position(std::clamp(r.get_X_position() + jitter(rng), 0.0, side),
+                            std::clamp(r.get_Y_position() + jitter(rng), 0.0, side));
+    }
+    report_sweep("after drift       ", fleet, radius, side);
+
+    start = Clock::now();
+    size_t moved = fleet.resort();
+    std::cout << "  incremental resort: " << seconds_since(start) * 1e3 << " ms, " << moved << " robots moved\n";
+    report_sweep("after resort      ", fleet, radius, side);
+
+    std::cout << "  robot ID 0 now lives in slot " << fleet.slot_of(0) << ": ";
+    fleet.robot(0).print_position3D();
+}
+
+/**
+ * @brief Main function - compares neighbor sweeps in construction, Morton and Hilbert order
+ * @return 0 on successful execution
+ */
+int main(int argc, char** argv){
+    size_t robots = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    unsigned workers = argc > 2 ? unsigned(std::strtoul(argv[2], nullptr, 10))
+                                : std::max(std::thread::hardware_concurrency(), 1u);
+    robots = std::max<size_t>(robots, 2);
+
+    bench_curve(Curve::Morton, robots, workers);
+    bench_curve(Curve::Hilbert, robots, workers);
+
+    // 3D fleets sort on (X, Y, Z)
+    for (Curve curve : {Curve::Morton, Curve::Hilbert}){
+        SpatialFleet arms(curve, true, workers);
+        arms.add(point3D("Robotic_arm", 1.1, 0.5, 3.3));
+        arms.add(point3D("Robotic_arm", 0.0, 0.0, 0.0));
+        arms.add(point3D("Robotic_arm", 1.0, 0.5, 3.0));
+        arms.reorder();
+        std::cout << curve_name(arms.curve()) << " order, (X, Y, Z) keys:\n";
+        for (size_t s = 0; s < arms.size(); s++) arms.at_slot(s).print_position3D();
+    }
+
+    return 0;
+}
+
+/**
+ * SPACE-FILLING CURVE NOTES:
+ * -------------------------
+ * 1. A space-filling curve visits every cell of a grid exactly once, so the
+ *    position along the curve turns a 2D/3D position into one sortable number
+ * 2. Morton (Z-order): interleave the bits of X, Y (and Z). Cheap to compute,
+ *    but the curve makes long jumps at the borders of big quadrants
+ * 3. Hilbert: consecutive cells are always adjacent, so locality is a bit
+ *    better, at the cost of a loop per bit instead of a few shifts
+ *
+ * WHY IT HELPS:
+ * ------------
+ * - Robots near each other in space now sit near each other in memory, so a
+ *   neighbor sweep touches cache lines that are already loaded
+ * - Callers keep using IDs: robot(id) goes through Slot_of and never changes
+ *   meaning when the storage is shuffled
+ */